@@ -14,17 +14,45 @@
 
 #define LOG_DIR "logs"
 #define MAX_INPUT 512
+#define LISTENER_HASH_SIZE 64
+#define CHANGE_LOG_SIZE 256
 
 // Structure definitions
 typedef struct Agent Agent;
 typedef struct Listener Listener;
 typedef struct Project Project;
+typedef struct StatCount StatCount;
+typedef struct Change Change;
+
+typedef struct StatCount {
+    char key[256];
+    int count;
+    struct StatCount* next;
+} StatCount;
+
+typedef struct Change {
+    unsigned long seq;
+    time_t at;
+    const char* kind;
+    const char* action;
+    char detail[512];
+} Change;
 
 typedef struct Project {
     char name[128];
     char description[512];
     struct Agent* C_agent;
     struct Project* next;
+    // Dashboard rollups, kept up to date on every agent mutation
+    int agent_count;
+    int active_count;
+    int admin_count;
+    struct StatCount* os_counts;
+    struct StatCount* arch_counts;
+    time_t newest_first_seen;
+    struct Agent* seen_head;
+    struct Agent* seen_tail;
+    unsigned long seq;
 } Project;
 
 typedef struct Agent {
@@ -43,10 +71,16 @@ typedef struct Agent {
     char description[512];
     int status;
     struct Listener* listener;
+    struct Project* project;
+    struct Agent* L_prev;
+    struct Agent* L_next;
+    struct Agent* S_prev;
+    struct Agent* S_next;
     struct Agent* P_agent;
     struct Agent* N_agent;
     struct Agent* C_agent;
     char log_path[256];
+    unsigned long seq;
 } Agent;
 
 typedef struct Listener {
@@ -59,13 +93,24 @@ typedef struct Listener {
     time_t created_at;
     char log_path[256];
     struct Agent* child_agent;
+    int agent_count;
+    struct Listener* next;
+    struct Listener* name_next;
+    struct Listener* endpoint_next;
+    unsigned long seq;
 } Listener;
 
 // Global variables
 Project* project_list = NULL;
 Project* current_project = NULL;
 Listener* listener_list = NULL;
+Listener* listener_tail = NULL;
+Listener* listener_name_table[LISTENER_HASH_SIZE] = { NULL };
+Listener* listener_endpoint_table[LISTENER_HASH_SIZE] = { NULL };
 int next_session_id = 1;
+Change change_log[CHANGE_LOG_SIZE];
+unsigned long next_change_seq = 1;
+unsigned long watch_cursor = 0;
 
 // Function declarations
 void print_banner();
@@ -78,15 +123,31 @@ void delete_project(char* name);
 Project* find_project(char* name);
 void create_listener();
 void list_listeners();
+void show_listener_info(char* name);
 void create_agent();
 void list_agents(Agent* root, int depth);
 void show_agent_info(int session_id);
 void delete_agent(int session_id);
+void checkin_agent(int session_id);
+void show_project_stats();
+void stat_count_add(StatCount** head, char* key);
+void free_stat_counts(StatCount* head);
+void touch_agent_seen(Project* project, Agent* agent);
+unsigned long record_change(const char* kind, const char* action, const char* detail);
+void record_agent_change(Agent* agent, const char* action);
+void show_changes(unsigned long since, const char* kind);
+void watch_agents();
 void write_log(int session_id, char* content);
 void view_log(int session_id);
 void cleanup();
 Agent* find_agent(Agent* root, int session_id);
 Listener* find_listener(char* name);
+Listener* find_listener_by_endpoint(int* ipv4, int port);
+unsigned int hash_listener_name(const char* name);
+unsigned int hash_listener_endpoint(int* ipv4, int port);
+void bind_agent_listener(Agent* agent, Listener* listener);
+void unbind_agent_listener(Agent* agent);
+void unbind_agent_tree(Agent* root);
 
 // Function definitions
 
@@ -96,9 +157,10 @@ void print_banner() {
 
 void print_help() {
     printf("\nCommands:\n");
-    printf("  project init / project list / project switch <name> / project delete <name>\n");
-    printf("  listener create / listener list\n");
-    printf("  agent create / agent list / agent info <id> / agent delete <id>\n");
+    printf("  project init / project list / project stats / project switch <name> / project delete <name>\n");
+    printf("  listener create / listener list / listener info <name>\n");
+    printf("  agent create / agent list / agent info <id> / agent delete <id> / agent checkin <id>\n");
+    printf("  agent watch / changes [--since <seq>]\n");
     printf("  log write <id> <text> / log view <id>\n");
     printf("  help / exit\n");
 }
@@ -142,6 +204,15 @@ void init_project() {
 
     new_project->C_agent = NULL;
     new_project->next = NULL;
+    new_project->agent_count = 0;
+    new_project->active_count = 0;
+    new_project->admin_count = 0;
+    new_project->os_counts = NULL;
+    new_project->arch_counts = NULL;
+    new_project->newest_first_seen = 0;
+    new_project->seen_head = NULL;
+    new_project->seen_tail = NULL;
+    new_project->seq = record_change("project", "create", new_project->name);
 
     if (!project_list) {
         project_list = new_project;
@@ -167,10 +238,13 @@ void list_projects() {
     int count = 1;
 
     while (temp) {
-        printf("%d. %s - %s %s\n",
+        printf("%d. %s - %s - Agents: %d (%d active) - Last Change: #%lu %s\n",
             count++,
             temp->name,
             temp->description,
+            temp->agent_count,
+            temp->active_count,
+            temp->seq,
             (temp == current_project) ? "[ACTIVE]" : "");
         temp = temp->next;
     }
@@ -214,6 +288,10 @@ void delete_project(char* name) {
                 }
             }
 
+            unbind_agent_tree(temp->C_agent);
+            record_change("project", "delete", temp->name);
+            free_stat_counts(temp->os_counts);
+            free_stat_counts(temp->arch_counts);
             free(temp);
             printf("Project '%s' deleted.\n", name);
             return;
@@ -232,6 +310,12 @@ void create_listener() {
     fgets(new_listener->name, 128, stdin);
     new_listener->name[strcspn(new_listener->name, "\n")] = 0;
 
+    if (find_listener(new_listener->name)) {
+        printf("Listener '%s' already exists.\n", new_listener->name);
+        free(new_listener);
+        return;
+    }
+
     printf("Protocol (http/https/smb): ");
     fgets(new_listener->protocol, 10, stdin);
     new_listener->protocol[strcspn(new_listener->protocol, "\n")] = 0;
@@ -245,6 +329,16 @@ void create_listener() {
     scanf("%d", &new_listener->port);
     getchar();
 
+    Listener* conflict = find_listener_by_endpoint(new_listener->ipv4, new_listener->port);
+    if (conflict) {
+        printf("Endpoint %d.%d.%d.%d:%d already used by listener '%s'.\n",
+            new_listener->ipv4[0], new_listener->ipv4[1],
+            new_listener->ipv4[2], new_listener->ipv4[3],
+            new_listener->port, conflict->name);
+        free(new_listener);
+        return;
+    }
+
     printf("Path: ");
     fgets(new_listener->path, 256, stdin);
     new_listener->path[strcspn(new_listener->path, "\n")] = 0;
@@ -252,6 +346,8 @@ void create_listener() {
     new_listener->status = 1;
     new_listener->created_at = time(NULL);
     new_listener->child_agent = NULL;
+    new_listener->agent_count = 0;
+    new_listener->next = NULL;
 
     snprintf(new_listener->log_path, 256, "%s/listener_%s.log", LOG_DIR, new_listener->name);
 
@@ -272,10 +368,23 @@ void create_listener() {
         listener_list = new_listener;
     }
     else {
-        Listener* temp = listener_list;
-        while (temp->child_agent) temp = (Listener*)temp->child_agent;
-        temp->child_agent = (Agent*)new_listener;
+        listener_tail->next = new_listener;
     }
+    listener_tail = new_listener;
+
+    unsigned int name_idx = hash_listener_name(new_listener->name);
+    new_listener->name_next = listener_name_table[name_idx];
+    listener_name_table[name_idx] = new_listener;
+
+    unsigned int endpoint_idx = hash_listener_endpoint(new_listener->ipv4, new_listener->port);
+    new_listener->endpoint_next = listener_endpoint_table[endpoint_idx];
+    listener_endpoint_table[endpoint_idx] = new_listener;
+
+    char detail[256];
+    snprintf(detail, 256, "%s %s://%d.%d.%d.%d:%d", new_listener->name, new_listener->protocol,
+        new_listener->ipv4[0], new_listener->ipv4[1], new_listener->ipv4[2], new_listener->ipv4[3],
+        new_listener->port);
+    new_listener->seq = record_change("listener", "create", detail);
 
     printf("Listener '%s' created.\n", new_listener->name);
 }
@@ -291,15 +400,89 @@ void list_listeners() {
     int count = 1;
 
     while (temp != NULL) {
-        printf("%d. %s [%s] - %d.%d.%d.%d:%d%s - Status: %s\n",
+        printf("%d. %s [%s] - %d.%d.%d.%d:%d%s - Status: %s - Agents: %d\n",
             count++, temp->name, temp->protocol,
             temp->ipv4[0], temp->ipv4[1], temp->ipv4[2], temp->ipv4[3],
             temp->port, temp->path,
-            temp->status ? "Running" : "Stopped");
-        temp = (Listener*)temp->child_agent;
+            temp->status ? "Running" : "Stopped",
+            temp->agent_count);
+        temp = temp->next;
     }
 }
 
+void show_listener_info(char* name) {
+    Listener* listener = find_listener(name);
+    if (!listener) {
+        printf("Listener '%s' not found.\n", name);
+        return;
+    }
+
+    char time_str[26];
+    struct tm* tm_info = localtime(&listener->created_at);
+    strftime(time_str, 26, "%Y-%m-%d %H:%M:%S", tm_info);
+
+    printf("\n=== Listener Information ===\n");
+    printf("Name: %s\n", listener->name);
+    printf("Endpoint: %s://%d.%d.%d.%d:%d%s\n", listener->protocol,
+        listener->ipv4[0], listener->ipv4[1], listener->ipv4[2], listener->ipv4[3],
+        listener->port, listener->path);
+    printf("Status: %s\n", listener->status ? "Running" : "Stopped");
+    printf("Created: %s\n", time_str);
+    printf("Log File: %s\n", listener->log_path);
+    printf("Last Change: #%lu\n", listener->seq);
+    printf("Agents: %d\n", listener->agent_count);
+
+    // Members are kept on the listener itself, newest first
+    Agent* temp = listener->child_agent;
+    while (temp) {
+        printf("  [%d] %s@%s (%s) - %s\n",
+            temp->session_id, temp->username, temp->hostname, temp->OS,
+            temp->status ? "Active" : "Inactive");
+        temp = temp->L_next;
+    }
+}
+
+void bind_agent_listener(Agent* agent, Listener* listener) {
+    agent->listener = listener;
+    agent->L_prev = NULL;
+    agent->L_next = listener->child_agent;
+    if (listener->child_agent) listener->child_agent->L_prev = agent;
+    listener->child_agent = agent;
+    listener->agent_count++;
+
+    char detail[256];
+    snprintf(detail, 256, "%s <- agent %d", listener->name, agent->session_id);
+    listener->seq = record_change("listener", "bind", detail);
+    record_agent_change(agent, "bind");
+}
+
+void unbind_agent_listener(Agent* agent) {
+    Listener* listener = agent->listener;
+    if (!listener) return;
+
+    if (agent->L_prev) agent->L_prev->L_next = agent->L_next;
+    else listener->child_agent = agent->L_next;
+    if (agent->L_next) agent->L_next->L_prev = agent->L_prev;
+
+    agent->listener = NULL;
+    agent->L_prev = NULL;
+    agent->L_next = NULL;
+    listener->agent_count--;
+
+    char detail[256];
+    snprintf(detail, 256, "%s -> agent %d", listener->name, agent->session_id);
+    listener->seq = record_change("listener", "unbind", detail);
+    record_agent_change(agent, "unbind");
+}
+
+void unbind_agent_tree(Agent* root) {
+    if (root == NULL) return;
+
+    unbind_agent_listener(root);
+    unbind_agent_tree(root->C_agent);
+    unbind_agent_tree(root->N_agent);
+}
+
 Agent* find_agent(Agent* root, int session_id) {
     if (root == NULL) return NULL;
 
@@ -360,6 +543,11 @@ void create_agent() {
     fgets(new_agent->description, 512, stdin);
     new_agent->description[strcspn(new_agent->description, "\n")] = 0;
 
+    printf("Listener name (blank for none): ");
+    char listener_name[128];
+    fgets(listener_name, 128, stdin);
+    listener_name[strcspn(listener_name, "\n")] = 0;
+
     printf("Parent agent ID (0 for root): ");
     int parent_id;
     scanf("%d", &parent_id);
@@ -369,6 +557,11 @@ void create_agent() {
     new_agent->last_seen = new_agent->first_seen;
     new_agent->status = 1;
     new_agent->listener = NULL;
+    new_agent->project = current_project;
+    new_agent->L_prev = NULL;
+    new_agent->L_next = NULL;
+    new_agent->S_prev = NULL;
+    new_agent->S_next = NULL;
     new_agent->P_agent = NULL;
     new_agent->N_agent = NULL;
     new_agent->C_agent = NULL;
@@ -420,6 +613,28 @@ void create_agent() {
         }
     }
 
+    current_project->agent_count++;
+    current_project->active_count++;
+    if (new_agent->privilege) current_project->admin_count++;
+    stat_count_add(&current_project->os_counts, new_agent->OS);
+    stat_count_add(&current_project->arch_counts, new_agent->architecture);
+    if (new_agent->first_seen > current_project->newest_first_seen) {
+        current_project->newest_first_seen = new_agent->first_seen;
+    }
+    touch_agent_seen(current_project, new_agent);
+
+    record_agent_change(new_agent, "create");
+
+    if (strlen(listener_name) > 0) {
+        Listener* listener = find_listener(listener_name);
+        if (listener) {
+            bind_agent_listener(new_agent, listener);
+        }
+        else {
+            printf("Listener '%s' not found. Agent left unbound.\n", listener_name);
+        }
+    }
+
     printf("Agent created. Session ID: %d\n", new_agent->session_id);
 }
 
@@ -467,6 +682,7 @@ void show_agent_info(int session_id) {
     printf("Privilege: %s\n", agent->privilege ? "Admin" : "User");
     printf("Process: %s (PID: %d)\n", agent->process, agent->pid);
     printf("Status: %s\n", agent->status ? "Active" : "Inactive");
+    printf("Listener: %s\n", agent->listener ? agent->listener->name : "(none)");
 
     tm_info = localtime(&agent->first_seen);
     strftime(time_str1, 26, "%Y-%m-%d %H:%M:%S", tm_info);
@@ -484,11 +700,14 @@ void show_agent_info(int session_id) {
         printf("Description: %s\n", agent->description);
 
     printf("Log File: %s\n", agent->log_path);
+    printf("Last Change: #%lu\n", agent->seq);
 }
 
 void delete_agent(int session_id) {
     Agent* agent = find_agent(current_project ? current_project->C_agent : NULL, session_id);
     if (agent) {
+        int was_active = agent->status;
+        if (was_active) current_project->active_count--;
         agent->status = 0;
         time_t now = time(NULL);
         FILE* fp = fopen(agent->log_path, "a");
@@ -499,6 +718,7 @@ void delete_agent(int session_id) {
             fprintf(fp, "[%s] Agent deleted\n", time_str);
             fclose(fp);
         }
+        if (was_active) record_agent_change(agent, "delete");
         printf("Agent %d marked as inactive.\n", session_id);
     }
     else {
@@ -506,6 +726,162 @@ void delete_agent(int session_id) {
     }
 }
 
+void checkin_agent(int session_id) {
+    Agent* agent = find_agent(current_project ? current_project->C_agent : NULL, session_id);
+    if (!agent) {
+        printf("Agent not found.\n");
+        return;
+    }
+
+    if (!agent->status) current_project->active_count++;
+    agent->status = 1;
+    agent->last_seen = time(NULL);
+    touch_agent_seen(current_project, agent);
+
+    FILE* fp = fopen(agent->log_path, "a");
+    if (fp) {
+        char time_str[26];
+        struct tm* tm_info = localtime(&agent->last_seen);
+        strftime(time_str, 26, "%Y-%m-%d %H:%M:%S", tm_info);
+        fprintf(fp, "[%s] Agent checked in\n", time_str);
+        fclose(fp);
+    }
+    record_agent_change(agent, "checkin");
+    printf("Agent %d checked in.\n", session_id);
+}
+
+void stat_count_add(StatCount** head, char* key) {
+    StatCount* temp = *head;
+    while (temp) {
+        if (strcmp(temp->key, key) == 0) {
+            temp->count++;
+            return;
+        }
+        temp = temp->next;
+    }
+
+    StatCount* new_count = (StatCount*)malloc(sizeof(StatCount));
+    snprintf(new_count->key, 256, "%s", key);
+    new_count->count = 1;
+    new_count->next = *head;
+    *head = new_count;
+}
+
+void free_stat_counts(StatCount* head) {
+    while (head) {
+        StatCount* next = head->next;
+        free(head);
+        head = next;
+    }
+}
+
+// Moves an agent to the tail of the project's last_seen list.
+// last_seen only ever moves forward, so the head is always the oldest.
+void touch_agent_seen(Project* project, Agent* agent) {
+    if (project->seen_tail == agent) return;
+
+    if (agent->S_prev) agent->S_prev->S_next = agent->S_next;
+    else if (project->seen_head == agent) project->seen_head = agent->S_next;
+    if (agent->S_next) agent->S_next->S_prev = agent->S_prev;
+
+    agent->S_prev = project->seen_tail;
+    agent->S_next = NULL;
+    if (project->seen_tail) project->seen_tail->S_next = agent;
+    else project->seen_head = agent;
+    project->seen_tail = agent;
+}
+
+void show_project_stats() {
+    if (!current_project) {
+        printf("Initialize project first (project init).\n");
+        return;
+    }
+
+    Project* proj = current_project;
+    printf("\n=== Project Stats: %s ===\n", proj->name);
+    printf("Agents: %d\n", proj->agent_count);
+    printf("Status: %d active / %d inactive\n",
+        proj->active_count, proj->agent_count - proj->active_count);
+    printf("Privilege: %d admin / %d user\n",
+        proj->admin_count, proj->agent_count - proj->admin_count);
+
+    printf("OS:\n");
+    for (StatCount* temp = proj->os_counts; temp; temp = temp->next) {
+        printf("  %s: %d\n", temp->key, temp->count);
+    }
+    printf("Architecture:\n");
+    for (StatCount* temp = proj->arch_counts; temp; temp = temp->next) {
+        printf("  %s: %d\n", temp->key, temp->count);
+    }
+
+    if (proj->agent_count > 0) {
+        char time_str[26];
+        struct tm* tm_info = localtime(&proj->newest_first_seen);
+        strftime(time_str, 26, "%Y-%m-%d %H:%M:%S", tm_info);
+        printf("Newest First Seen: %s\n", time_str);
+
+        tm_info = localtime(&proj->seen_head->last_seen);
+        strftime(time_str, 26, "%Y-%m-%d %H:%M:%S", tm_info);
+        printf("Oldest Last Seen: %s (agent %d)\n", time_str, proj->seen_head->session_id);
+    }
+    printf("Last Change: #%lu\n", proj->seq);
+}
+
+// Appends to the change ring buffer; once full, the oldest entry is overwritten.
+unsigned long record_change(const char* kind, const char* action, const char* detail) {
+    unsigned long seq = next_change_seq++;
+    Change* change = &change_log[seq % CHANGE_LOG_SIZE];
+    change->seq = seq;
+    change->at = time(NULL);
+    change->kind = kind;
+    change->action = action;
+    snprintf(change->detail, 512, "%s", detail);
+    return seq;
+}
+
+// Agent changes also stamp the owning project, whose rollups they touch.
+void record_agent_change(Agent* agent, const char* action) {
+    char detail[512];
+    snprintf(detail, 512, "[%d] %s@%s in %s", agent->session_id,
+        agent->username, agent->hostname, agent->project->name);
+    agent->seq = record_change("agent", action, detail);
+    agent->project->seq = agent->seq;
+}
+
+void show_changes(unsigned long since, const char* kind) {
+    unsigned long latest = next_change_seq - 1;
+    unsigned long oldest = (latest >= CHANGE_LOG_SIZE) ? latest - CHANGE_LOG_SIZE + 1 : 1;
+
+    if (since > latest) since = latest;
+
+    if (since + 1 < oldest) {
+        printf("Changes #%lu-#%lu were dropped; re-list to resync.\n", since + 1, oldest - 1);
+        since = oldest - 1;
+    }
+
+    int count = 0;
+    for (unsigned long seq = since + 1; seq <= latest; seq++) {
+        Change* change = &change_log[seq % CHANGE_LOG_SIZE];
+        if (kind && strcmp(change->kind, kind) != 0) continue;
+
+        char time_str[26];
+        struct tm* tm_info = localtime(&change->at);
+        strftime(time_str, 26, "%Y-%m-%d %H:%M:%S", tm_info);
+        printf("#%lu [%s] %s %s - %s\n",
+            change->seq, time_str, change->kind, change->action, change->detail);
+        count++;
+    }
+
+    if (count == 0) printf("No changes.\n");
+    printf("Latest sequence: %lu\n", latest);
+}
+
+void watch_agents() {
+    printf("\n=== Agent changes since #%lu ===\n", watch_cursor);
+    show_changes(watch_cursor, "agent");
+    watch_cursor = next_change_seq - 1;
+}
+
 void write_log(int session_id, char* content) {
     Agent* agent = find_agent(current_project ? current_project->C_agent : NULL, session_id);
     if (!agent) {
@@ -545,20 +921,51 @@ void view_log(int session_id) {
     }
 }
 
+unsigned int hash_listener_name(const char* name) {
+    unsigned int hash = 5381;
+    while (*name) {
+        hash = hash * 33 + (unsigned char)*name++;
+    }
+    return hash % LISTENER_HASH_SIZE;
+}
+
+unsigned int hash_listener_endpoint(int* ipv4, int port) {
+    unsigned int hash = 5381;
+    for (int i = 0; i < 4; i++) {
+        hash = hash * 33 + (unsigned int)ipv4[i];
+    }
+    hash = hash * 33 + (unsigned int)port;
+    return hash % LISTENER_HASH_SIZE;
+}
+
 Listener* find_listener(char* name) {
-    Listener* temp = listener_list;
+    Listener* temp = listener_name_table[hash_listener_name(name)];
     while (temp != NULL) {
         if (strcmp(temp->name, name) == 0) return temp;
-        temp = (Listener*)temp->child_agent;
+        temp = temp->name_next;
+    }
+    return NULL;
+}
+
+Listener* find_listener_by_endpoint(int* ipv4, int port) {
+    Listener* temp = listener_endpoint_table[hash_listener_endpoint(ipv4, port)];
+    while (temp != NULL) {
+        if (memcmp(temp->ipv4, ipv4, sizeof(temp->ipv4)) == 0 && temp->port == port) return temp;
+        temp = temp->endpoint_next;
     }
     return NULL;
 }
 
 void cleanup() {
     printf("Cleaning up resources...\n");
-    if (current_project) {
-        free(current_project);
+    while (project_list) {
+        Project* next = project_list->next;
+        free_stat_counts(project_list->os_counts);
+        free_stat_counts(project_list->arch_counts);
+        free(project_list);
+        project_list = next;
     }
+    current_project = NULL;
 }
 
 int main() {
@@ -589,6 +996,9 @@ int main() {
         else if (strcmp(command, "project list") == 0) {
             list_projects();
         }
+        else if (strcmp(command, "project stats") == 0) {
+            show_project_stats();
+        }
         else if (strncmp(command, "project switch", 14) == 0) {
             char name[128];
             if (sscanf(command, "project switch %[^\n]", name) == 1) {
@@ -613,6 +1023,15 @@ int main() {
         else if (strcmp(command, "listener list") == 0) {
             list_listeners();
         }
+        else if (strncmp(command, "listener info", 13) == 0) {
+            char name[128];
+            if (sscanf(command, "listener info %127[^\n]", name) == 1) {
+                show_listener_info(name);
+            }
+            else {
+                printf("Usage: listener info <name>\n");
+            }
+        }
         else if (strncmp(command, "agent create", 12) == 0) {
             create_agent();
         }
@@ -625,6 +1044,9 @@ int main() {
                 printf("No project initialized or no agents available.\n");
             }
         }
+        else if (strcmp(command, "agent watch") == 0) {
+            watch_agents();
+        }
         else if (strncmp(command, "agent info", 10) == 0) {
             int sid;
             if (sscanf(command, "agent info %d", &sid) == 1) {
@@ -643,6 +1065,26 @@ int main() {
                 printf("Usage: agent delete <session_id>\n");
             }
         }
+        else if (strncmp(command, "agent checkin", 13) == 0) {
+            int sid;
+            if (sscanf(command, "agent checkin %d", &sid) == 1) {
+                checkin_agent(sid);
+            }
+            else {
+                printf("Usage: agent checkin <session_id>\n");
+            }
+        }
+        else if (strncmp(command, "changes", 7) == 0) {
+            long since = 0;
+            char extra;
+            if (strcmp(command, "changes") == 0 ||
+                (sscanf(command, "changes --since %ld %c", &since, &extra) == 1 && since >= 0)) {
+                show_changes((unsigned long)since, NULL);
+            }
+            else {
+                printf("Usage: changes [--since <seq>]\n");
+            }
+        }
         else if (strncmp(command, "log write", 9) == 0) {
             int sid;
             char content[MAX_INPUT];